@@ -35,4 +35,8 @@ CREATE TABLE borrow_records (
     is_returned BOOLEAN DEFAULT FALSE,
     FOREIGN KEY (user_id) REFERENCES users(user_id),
     FOREIGN KEY (book_id) REFERENCES books(book_id)
-);
\ No newline at end of file
+);
+
+-- Indexes, stored procedures and later schema changes are applied as numbered
+-- migrations by the application at startup (see schemaMigrations() in
+-- LIBRARY_MANAGEMENT_SYSTEM.cpp); applied versions are tracked in schema_migrations.